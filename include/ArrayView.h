@@ -0,0 +1,25 @@
+#ifndef ARRAYVIEW_H
+#define ARRAYVIEW_H
+
+#include <cstddef>
+#include <vector>
+
+// Read-only view of 'size' contiguous values, normally the std::vector
+// buffer of a tree branch, so events are used without a copy. A null vector
+// gives an empty view.
+template <class T>
+struct ArrayView {
+    const T* data;
+    size_t size;
+
+    ArrayView() : data(nullptr), size(0) {}
+    ArrayView(const T* d, size_t n) : data(d), size(n) {}
+    ArrayView(const std::vector<T>* v) : data(v ? v->data() : nullptr), size(v ? v->size() : 0) {}
+
+    bool empty() const { return size == 0; }
+    const T& operator[](size_t i) const { return data[i]; }
+    const T* begin() const { return data; }
+    const T* end() const { return data + size; }
+};
+
+#endif
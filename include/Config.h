@@ -18,6 +18,23 @@ class Config {
 
     bool mode_debug;
     bool mode_event_display;
+    bool event_display_multipage;  // One multi-page PDF per run instead of one PDF per event
+
+    int n_threads;
+    bool fill_combined;
+    bool mode_skim;
+    int prefetch_depth;  // File pairs opened ahead of the one being processed, 0 = off
+    int tree_cache_mb;   // TTreeCache per input/output tree [MB], 0 = automatic (GetTreeCacheMB)
+    bool compact_histograms;  // Int/sparse histogram storage, off by default: false books everything as TH1D/TH2D
+    bool fill_pmt_maps;       // Per-PMT occupancy/PE/charge maps (PMTAccumulator), on by default: adds mcPMTID
+    bool fill_pmt_times;      // Adds the per-PMT hit time maps (hitPMTID/hitPMTTime), off by default
+    bool subev_prefilter;     // Production: read only subev == 0 output entries in full (SubevPrefilterReader)
+
+    // File pairs [first_file, end_file) of this run and the shard it is, recorded in t_parameters
+    int first_file;
+    int end_file;
+    int shard;
+    int n_shards;
 
     double histo_half_range;
     int n_bins_h1d_Ediff;
@@ -27,14 +44,40 @@ class Config {
 
     void SetDebugMode(bool debug) { mode_debug = debug; }
     void SetEventDisplayMode(bool ed) { mode_event_display = ed; }
+    void SetEventDisplayMultiPage(bool multipage) { event_display_multipage = multipage; }
     void SetCutNuFinal(bool cut) { cut_nuFinal = cut; }
     void SetCutToWall(bool cut) { cut_toWall = cut; }
     void SetCutEmatch(bool cut) { cut_Ematch = cut; }
     void SetETolerance(double tol) { E_tolerance = tol; }
     void SetDistanceCut(double dist) { distance_cut = dist; }
+    void SetNThreads(int n) { n_threads = n > 0 ? n : 1; }
+    void SetFillCombined(bool combined) { fill_combined = combined; }
+    void SetSkimMode(bool skim) { mode_skim = skim; }
+    void SetPrefetchDepth(int depth) { prefetch_depth = depth > 0 ? depth : 0; }
+    void SetTreeCacheMB(int mb) { tree_cache_mb = mb > 0 ? mb : 0; }
+    void SetCompactHistograms(bool compact) { compact_histograms = compact; }
+    void SetFillPMTMaps(bool fill) { fill_pmt_maps = fill; }
+    void SetFillPMTTimes(bool fill) { fill_pmt_times = fill; }
+    void SetSubevPrefilter(bool prefilter) { subev_prefilter = prefilter; }
+    void SetFileRange(int first, int end) { first_file = first; end_file = end; }
+    void SetShard(int i, int n) { shard = i; n_shards = n > 0 ? n : 1; }
 
     bool GetDebugMode() const { return mode_debug; }
     bool GetEventDisplayMode() const { return mode_event_display; }
+    bool GetEventDisplayMultiPage() const { return event_display_multipage; }
+    int GetNThreads() const { return n_threads; }
+    bool GetFillCombined() const { return fill_combined; }
+    bool GetSkimMode() const { return mode_skim; }
+    int GetPrefetchDepth() const { return prefetch_depth; }
+    int GetTreeCacheMB() const;
+    bool GetCompactHistograms() const { return compact_histograms; }
+    bool GetFillPMTMaps() const { return fill_pmt_maps; }
+    bool GetFillPMTTimes() const { return fill_pmt_maps && fill_pmt_times; }
+    bool GetSubevPrefilter() const { return subev_prefilter; }
+    int GetFirstFile() const { return first_file; }
+    int GetEndFile() const { return end_file; }
+    int GetShard() const { return shard; }
+    int GetNShards() const { return n_shards; }
 
     TString GetTimestamp() const;
 
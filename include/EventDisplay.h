@@ -1,11 +1,14 @@
 #ifndef EVENTDISPLAY_H
 #define EVENTDISPLAY_H
 
+#include <TCanvas.h>
 #include <TFile.h>
+#include <TH2D.h>
+#include <TPad.h>
+#include <TPaveText.h>
 #include <TTree.h>
-#include <TVector3.h>
 
-#include <map>
+#include <string>
 #include <vector>
 
 #include "RAT/DS/MC.hh"
@@ -39,12 +42,32 @@ class EventDisplay {
 
     bool IsGeometryLoaded() const { return geometry_loaded; }
 
+    // Write all following displays as pages of one PDF instead of one file per event
+    bool OpenMultiPage(const char* filename);
+    void CloseMultiPage();
+
    private:
     // PMT geometry
-    std::map<int, TVector3> pmtPos;
     double xmin, xmax, ymin, ymax, zmin, zmax;
     bool geometry_loaded;
+    int n_pmts;
+
+    // Dense lookup indexed by PMT ID, built once in LoadGeometry: the face the
+    // PMT sits on (-1 if none) and its global bin in that face's histogram
+    std::vector<int> pmt_face;
+    std::vector<int> pmt_bin;
+
+    // Canvas, pads and face histograms are booked once and reset per event
+    TCanvas* canvas;
+    TPad* pads[6];
+    TPad* text_pad;
+    TH2D* face_hists[6];
+    TPaveText* info;
+
+    std::string multipage_name;
+    bool open_pdf_pending;  // Set by OpenMultiPage, cleared once "name[" opened the PDF
 
+    // Same order as PMTGeometry::Face
     enum Face { ZP = 0,
                 ZM = 1,
                 XP = 2,
@@ -52,8 +75,9 @@ class EventDisplay {
                 YP = 4,
                 YM = 5 };
 
-    void AssignPMTsToFaces(std::vector<std::vector<int>>& face_pmts);
-    void DrawFace(int face, int evt_nr, const std::vector<int>& face_pmts, const std::map<int, int>& npe_map);
+    void BookFaceHistograms();
+    void SetupCanvas();
+    void DrawFace(int face);
 };
 
 #endif  // EVENTDISPLAY_H
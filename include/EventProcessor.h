@@ -1,11 +1,15 @@
 #ifndef EVENTPROCESSOR_H
 #define EVENTPROCESSOR_H
 
+#include <memory>
 #include <vector>
 
 #include "EventDisplay.h"
 #include "FileManager.h"
 #include "HistogramManager.h"
+#include "SubevPrefilterReader.h"
+#include "PMTGeometry.h"
+#include "SkimManager.h"
 #include "Statistics.h"
 
 class EventProcessor {
@@ -16,12 +20,26 @@ class EventProcessor {
     void ProcessFile(int file_nr, int dataset);
 
     void SetEventDisplay(EventDisplay* ed) { event_display = ed; }
+    void SetSkimManager(SkimManager* sm) { skim_manager = sm; }
+
+    static void FillHistograms(const SkimEvent& evt, HistogramManager& hm, Statistics& stats);
+    static bool PassesCuts(const SkimEvent& evt, Statistics& stats);
 
    private:
     FileManager& file_manager;
     HistogramManager& hist_manager;
     Statistics& statistics;
     EventDisplay* event_display;
+    SkimManager* skim_manager;
+
+    SkimEvent current_event;
+    std::vector<SkimEvent> skim_buffer;
+    int current_file_nr;
+    bool output_has_hits;  // The output tree has a hitPMTID branch
+
+    // PMT geometry from the meta tree, for the distance to wall and the PMT maps;
+    // null until loaded, shared with the PMTAccumulators of hist_manager
+    std::shared_ptr<const PMTGeometry> pmt_geometry;
 
     struct OutputBranches {
         Int_t evid, subev, mcid, mcparticlecount, mcpdg, nhits, mcpecount;
@@ -74,12 +92,22 @@ class EventProcessor {
 
     OutputBranches output_branches;
 
+    // Production reading of the output tree, see Config::subev_prefilter
+    SubevPrefilterReader prefilter_reader;
+
     void SetupOutputBranches(TTree* tree);
-    void EnableOnlyRequiredBranches(TTree* tree);
+    static void EnableOnlyRequiredBranches(TTree* tree);
+    // False if the 'ds' branch is not split as expected and is read in full
+    static bool EnableOnlyRequiredInputBranches(TTree* tree);
+
+    // The current per-entry branch buffers, as the event loop sees them
+    void GetOutputEvent(OutputEvent& out) const;
 
-    void ProcessEvent(int evt_nr, int dataset, RAT::DS::Root* ds, int entry_index);
+    void ProcessEvent(int evt_nr, int dataset, RAT::DS::Root* ds, int entry_index, const OutputEvent& out);
 
     void PrintEventInfo(int evt_nr, RAT::DS::MC* mc, int entry_index) const;
+
+    static void SumTrueKE(const SkimEvent& evt, double& input_total, double& output_total);
 };
 
 #endif
@@ -4,6 +4,8 @@
 #include <TFile.h>
 #include <TTree.h>
 
+#include <deque>
+#include <future>
 #include <string>
 
 class FileManager {
@@ -12,12 +14,24 @@ class FileManager {
     ~FileManager();
 
     void SetupPaths(const std::string& chunk);
+    void SetupLocalPaths(const std::string& base, const std::string& chunk);
+    void SetPaths(const std::string& input_path, const std::string& output_path);
     std::string GetInputPath() const { return input_file_path; }
     std::string GetOutputPath() const { return output_file_path; }
 
     bool OpenFiles(int file_nr);
     void CloseFiles();
 
+    // Background opening of upcoming file pairs (see OpenFiles)
+    typedef void (*TreeSetup)(TTree* tree);
+    void SetTreeSetup(TreeSetup input_setup, TreeSetup output_setup);
+    void Prefetch(int file_nr);
+    void CancelPrefetch();
+
+    double GetLastOpenSeconds() const { return last_open_seconds; }
+    double GetLastWaitSeconds() const { return last_wait_seconds; }
+    bool WasPrefetched() const { return last_prefetched; }
+
     TFile* GetInputFile() { return input_file; }
     TFile* GetOutputFile() { return output_file; }
     TTree* GetInputTree() { return input_tree; }
@@ -28,6 +42,10 @@ class FileManager {
     static bool FileExists(const std::string& fname);
     static std::string FindHostname(const std::string& chunk = "");
 
+    // Production directory layout below a local base directory
+    static std::string LocalInputPath(const std::string& base, const std::string& chunk);
+    static std::string LocalOutputPath(const std::string& base, const std::string& chunk);
+
    private:
     std::string input_file_path;
     std::string output_file_path;
@@ -41,7 +59,40 @@ class FileManager {
 
     bool files_valid;
 
+    struct FilePair {
+        std::string input_name;
+        std::string output_name;
+        TFile* input_file;
+        TFile* output_file;
+        TTree* input_tree;
+        TTree* output_tree;
+        bool valid;
+        double open_seconds;
+
+        FilePair();
+    };
+
+    struct PendingPair {
+        std::string input_name;
+        std::string output_name;
+        std::future<FilePair> result;
+    };
+
+    std::deque<PendingPair> prefetch_queue;
+    TreeSetup input_tree_setup;
+    TreeSetup output_tree_setup;
+
+    double last_open_seconds;
+    double last_wait_seconds;
+    bool last_prefetched;
+
     void FindPathsForHostname(const std::string& hostname, const std::string& chunk);
+
+    FilePair MakePair(int file_nr) const;
+    bool TakePrefetched(FilePair& pair);
+    static void OpenPair(FilePair& pair);
+    static void WarmPair(FilePair& pair, TreeSetup input_setup, TreeSetup output_setup);
+    static void ClosePair(FilePair& pair);
 };
 
 #endif
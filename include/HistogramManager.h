@@ -2,44 +2,103 @@
 #define HISTOGRAMMANAGER_H
 
 #include <TFile.h>
-#include <TH1D.h>
-#include <TH2D.h>
+#include <TH1.h>
+#include <THnSparse.h>
 #include <TTree.h>
 
+#include <memory>
+#include <vector>
+
+#include "ArrayView.h"
 #include "Config.h"
+#include "PMTAccumulator.h"
+#include "PMTGeometry.h"
+
+// Bin content type of a booked histogram. Sparse only applies to 2D
+// histograms; all fills are unweighted counts, so Int is exact.
+enum class HistStorage { Double, Float, Int, Sparse };
 
 class HistogramManager {
    public:
+    // Index into the histogram table; order matches Definitions()
+    enum HistId {
+        kEdiff,
+        kIoTotalEnergy,
+        kIoSingleEnergies,
+        kOPhotonsVsKE,
+        kOCherenkovPhotonsVsKE,
+        kOScintPhotonsVsKE,
+        kORemPhotonsVsKE,
+        kOPMTChargeVsKE,
+        kOPEsVsKE,
+        kNHistograms
+    };
+
+    // One histogram booked per sample slot: the sample tag is appended to
+    // name ("_01" ... "_combined") and title (" 01" ... " combined").
+    // ny == 0 books a 1D histogram.
+    struct HistDef {
+        HistId id;
+        const char* name;
+        const char* title;
+        const char* xtitle;
+        const char* ytitle;
+        int nx;
+        double xmin, xmax;
+        int ny;
+        double ymin, ymax;
+        HistStorage storage;
+    };
+
+    static std::vector<HistDef> Definitions();
+
     HistogramManager();
     ~HistogramManager();
 
-    void Initialize();
+    void Initialize(bool book_combined = true);
 
-    void InitializeOutputFile(const char* filename);
+    // Both return false if the output file cannot be created or written
+    bool InitializeOutputFile(const char* filename);
 
     void FillSingleEnergies(int dataset, double input_KE, double output_KE);
     void FillTotalEnergy(int dataset, double input_total, double output_total);
     void FillPhotonsVsKE(int dataset, double KE, double scint, double cher, double rem);
+    void FillPMTChargeVsKE(int dataset, double KE, double charge);
     void FillPEsVsKE(int dataset, double KE, double nPE);
     void FillEdiff(int dataset, double Ediff);
+    void FillPMTs(int dataset,
+                  const std::shared_ptr<const PMTGeometry>& geometry,
+                  ArrayView<int> mcPMTID,
+                  ArrayView<int> mcPMTNPE,
+                  ArrayView<double> mcPMTCharge,
+                  ArrayView<int> hitPMTID,
+                  ArrayView<double> hitPMTTime);
+
+    void Add(const HistogramManager& other);
 
     void Write(int dataset);
-    void CloseOutputFile();
+    bool CloseOutputFile();
+    TFile* GetOutputFile() const { return outFile; }
+
+    static TString SampleTag(int slot);
 
    private:
     TFile* outFile;
 
-    TH1D* h1d_Ediff[Config::NSAMPLES];
-    TH2D* h2d_ioTotalEnergy[Config::NSAMPLES];
-    TH2D* h2d_ioSingleEnergies[Config::NSAMPLES];
-    TH2D* h2d_oScintPhotonsVsKE[Config::NSAMPLES];
-    TH2D* h2d_oRemPhotonsVsKE[Config::NSAMPLES];
-    TH2D* h2d_oPhotonsVsKE[Config::NSAMPLES];
-    TH2D* h2d_oCherenkovPhotonsVsKE[Config::NSAMPLES];
-    TH2D* h2d_oPMTChargeVsKE[Config::NSAMPLES];
-    TH2D* h2d_oPEsVsKE[Config::NSAMPLES];
+    // Exactly one of dense/sparse is set for a booked histogram
+    TH1* dense[kNHistograms][Config::NSAMPLES];
+    THnSparse* sparse[kNHistograms][Config::NSAMPLES];
+
+    // Per-PMT maps per dataset; the combined maps are summed in Write(0)
+    PMTAccumulator pmt_maps[Config::NSAMPLES];
+
+    void Book(const HistDef& def, int slot);
+    void Fill(HistId id, int dataset, double x, double y = 0);
+    bool IsBooked(int slot) const;
 
     void CreateParameterTree();
+    void DeleteHistograms();
+    void AddSlot(int slot, const HistogramManager& other, int other_slot);
 };
 
 #endif
@@ -0,0 +1,97 @@
+#ifndef OUTPUTMERGER_H
+#define OUTPUTMERGER_H
+
+#include <TFile.h>
+#include <TH1.h>
+#include <THnBase.h>
+#include <TString.h>
+#include <TTree.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+// Sums any number of validate outputs (per-dataset runs, all-dataset runs,
+// validate_run shards) into one file: all histograms, the t_statistics and
+// t_timing counters, the t_file_timing rows, and rebuilds every *_combined
+// histogram from the per-dataset ones. Inputs are split across threads, each
+// summing its files one at a time into a single partial result, and the
+// partials are then added pairwise, so memory stays at about one set of
+// histograms per thread whatever the number of inputs.
+class OutputMerger {
+   public:
+    OutputMerger();
+    ~OutputMerger();
+
+    void SetNThreads(int n) { n_threads = n > 0 ? n : 1; }
+    void SetAllowOverlaps(bool allow) { allow_overlaps = allow; }
+
+    // Returns false, without leaving output_name behind, if an input cannot be
+    // read, a histogram's binning or the leaves of t_statistics/t_timing
+    // differ between inputs, the inputs were made with different t_parameters
+    // (file range, shard and tree cache size excepted), two inputs cover
+    // overlapping file ranges of a dataset (unless SetAllowOverlaps) or
+    // writing output_name fails
+    bool Merge(const std::vector<std::string>& input_names, const std::string& output_name);
+
+   private:
+    // All leaves of entry 0 of a flat tree (t_parameters, t_statistics, t_timing)
+    struct LeafValues {
+        std::vector<std::string> names;
+        std::vector<char> types;  // ROOT leaf type codes: O, I, L, F, D
+        std::vector<double> values;
+
+        bool Read(TTree* tree);
+        bool SameLayout(const LeafValues& other) const;
+        int Find(const std::string& name) const;
+        bool Write(TFile* file, const char* name, const char* title) const;
+    };
+
+    struct FileRange {
+        std::string file_name;
+        unsigned int datasets;  // Bit i set if the file has *_0i histograms
+        int first_file;
+        int end_file;
+    };
+
+    struct Partial {
+        std::map<std::string, TH1*> hists;
+        std::map<std::string, THnBase*> sparse;
+        LeafValues parameters;
+        LeafValues statistics;
+        LeafValues timing;
+        bool has_parameters;
+        bool has_statistics;
+        bool has_timing;
+        std::vector<FileRange> ranges;
+        std::vector<std::string> files_with_file_timing;
+        int n_files;
+        std::string error;
+
+        Partial();
+        ~Partial();
+    };
+
+    int n_threads;
+    bool allow_overlaps;
+
+    bool AddFile(Partial& partial, const std::string& file_name) const;
+    bool AddPartial(Partial& into, Partial& from) const;
+    bool AddHist(Partial& partial, TH1* h, const std::string& origin) const;
+    bool AddSparse(Partial& partial, THnBase* h, const std::string& origin) const;
+    bool AddParameters(Partial& partial, const LeafValues& parameters, const std::string& origin) const;
+    bool AddCounters(Partial& partial, LeafValues& into, bool& has, const LeafValues& from, const char* tree_name, const std::string& origin) const;
+
+    bool RebuildCombined(Partial& partial) const;
+    bool CheckRanges(const Partial& partial) const;
+    bool WriteOutput(Partial& partial, const std::string& output_name) const;
+
+    static bool SameBinning(const TAxis* a, const TAxis* b);
+    static bool SameBinning(const TH1* a, const TH1* b);
+    static bool SameBinning(const THnBase* a, const THnBase* b);
+    static int DatasetSlot(const TString& name, TString* prefix = nullptr);
+    static TString CombinedTitle(const TString& title, int slot);
+    static bool IsRangeParameter(const std::string& name);
+};
+
+#endif
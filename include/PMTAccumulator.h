@@ -0,0 +1,73 @@
+#ifndef PMTACCUMULATOR_H
+#define PMTACCUMULATOR_H
+
+#include <TFile.h>
+#include <TString.h>
+
+#include <memory>
+#include <vector>
+
+#include "ArrayView.h"
+#include "PMTGeometry.h"
+
+// Detector-wide per-PMT sums over all events of one sample: hit occupancy,
+// PEs, charge and hit times. Everything is a flat array over the dense PMT
+// index of PMTGeometry; index N (one past the last PMT) collects hits on
+// PMT IDs missing from the geometry, so the fill loops have no branches.
+// The geometry is shared, not copied, and the arrays are only allocated by
+// Initialize, i.e. on the first event of the sample; the hit time arrays
+// only on the first event with hit times.
+class PMTAccumulator {
+   public:
+    static const int N_TIME_BINS = 250;     // Per face
+    static const int N_PMT_TIME_BINS = 25;  // Per PMT
+    static constexpr double TIME_MIN = -100.0;  // [ns]
+    static constexpr double TIME_MAX = 400.0;
+
+    PMTAccumulator();
+
+    void Initialize(const std::shared_ptr<const PMTGeometry>& geo);
+    bool IsInitialized() const { return geometry != nullptr; }
+
+    void Fill(ArrayView<int> mcPMTID,
+              ArrayView<int> mcPMTNPE,
+              ArrayView<double> mcPMTCharge,
+              ArrayView<int> hitPMTID,
+              ArrayView<double> hitPMTTime);
+
+    void Add(const PMTAccumulator& other);
+
+    // Per-PMT (vs PMT ID) and per-face maps, named <name>_<tag>
+    void Write(TFile* file, const TString& tag) const;
+
+    Long64_t GetNEvents() const { return n_events; }
+    bool HasTimes() const { return !n_timed_hits.empty(); }
+
+   private:
+    std::shared_ptr<const PMTGeometry> geometry;
+    int n_pmts;
+    Long64_t n_events;
+
+    std::vector<double> occupancy;  // Events in which the PMT collected PEs
+    std::vector<double> npe;
+    std::vector<double> charge;
+    std::vector<double> n_timed_hits;
+    std::vector<double> time_sum;
+    std::vector<double> time_sum2;
+
+    // Coarse hit time distribution per PMT, (N_PMT_TIME_BINS + 2) bins with
+    // under/overflow per dense index (+ 1)
+    std::vector<double> pmt_time;
+
+    // Hit time distribution per face, (N_TIME_BINS + 2) bins with under/overflow;
+    // row NFACES collects PMTs that are on no face
+    std::vector<double> face_time;
+    std::vector<int> face_row;  // Per dense index (+ 1), row of face_time
+
+    std::vector<int> scratch_index;
+
+    void InitializeTimes();
+    void MapToIndex(ArrayView<int> pmt_ids);
+};
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef PMTGEOMETRY_H
+#define PMTGEOMETRY_H
+
+#include <TFile.h>
+#include <TTree.h>
+
+#include <vector>
+
+// PMT positions from the RATPAC 'meta' tree, with a dense index 0..N-1 so
+// that per-PMT quantities can live in flat arrays. Positions are in mm.
+class PMTGeometry {
+   public:
+    enum Face { ZP = 0,
+                ZM = 1,
+                XP = 2,
+                XM = 3,
+                YP = 4,
+                YM = 5,
+                NFACES = 6 };
+
+    PMTGeometry();
+
+    bool Load(TFile* output_file);
+    bool IsLoaded() const { return loaded; }
+
+    int GetNPMTs() const { return ids.size(); }
+    int GetMaxID() const { return (int)index_of_id.size() - 1; }
+
+    // Same PMT IDs in the same dense order, so per-index arrays can be summed
+    bool SameLayout(const PMTGeometry& other) const { return ids == other.ids; }
+
+    // Dense index of a PMT ID, -1 if the ID is not in the geometry
+    int Index(int pmt_id) const {
+        return (pmt_id >= 0 && pmt_id < (int)index_of_id.size()) ? index_of_id[pmt_id] : -1;
+    }
+
+    // 2D coordinates of a PMT on its face, and the face extent [mm]
+    void FaceCoordinates(int index, double& ax, double& ay) const;
+    void FaceRange(int face, double& axmin, double& axmax, double& aymin, double& aymax) const;
+
+    static void FaceBins(int face, int& nbx, int& nby);
+    static const char* FaceName(int face);
+    static const char* FaceTag(int face);
+    static const char* FaceAxisName(int face, int axis);
+
+    // Per dense index
+    std::vector<int> ids;
+    std::vector<double> x, y, z;
+    std::vector<int> face;  // -1 if the PMT is not on one of the six walls
+
+    double xmin, xmax, ymin, ymax, zmin, zmax;
+
+   private:
+    std::vector<int> index_of_id;
+    bool loaded;
+
+    int AssignFace(double px, double py, double pz) const;
+};
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef PARALLELPROCESSOR_H
+#define PARALLELPROCESSOR_H
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "EventDisplay.h"
+#include "EventProcessor.h"
+#include "FileManager.h"
+#include "HistogramManager.h"
+#include "SkimManager.h"
+#include "Statistics.h"
+
+struct FileTask {
+    int dataset;
+    int file_nr;
+};
+
+class ParallelProcessor {
+   public:
+    ParallelProcessor(HistogramManager& hm, Statistics& stats);
+    ~ParallelProcessor();
+
+    void AddDataset(int dataset, const FileManager& paths);
+    void AddFiles(int dataset, int first_file, int end_file);
+
+    void SetEventDisplay(EventDisplay* ed) { event_display = ed; }
+    void SetSkimManager(SkimManager* sm) { skim_manager = sm; }
+
+    void Run();
+
+    int GetNTasks() const { return tasks.size(); }
+
+   private:
+    HistogramManager& hist_manager;
+    Statistics& statistics;
+    EventDisplay* event_display;
+    SkimManager* skim_manager;
+
+    struct DatasetPaths {
+        std::string input_path;
+        std::string output_path;
+    };
+
+    std::map<int, DatasetPaths> dataset_paths;
+    std::vector<FileTask> tasks;
+
+    void RunSerial();
+    void RunParallel(int n_threads);
+    void ProcessTasks(FileManager& file_manager, EventProcessor& processor,
+                      const std::function<size_t()>& claim_task, std::atomic<int>& n_done);
+
+    void PrintProgress(int n_done) const;
+};
+
+#endif
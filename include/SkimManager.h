@@ -0,0 +1,61 @@
+#ifndef SKIMMANAGER_H
+#define SKIMMANAGER_H
+
+#include <TFile.h>
+#include <TTree.h>
+
+#include <mutex>
+#include <vector>
+
+#include "HistogramManager.h"
+#include "Statistics.h"
+
+// One flat record per matched (subev == 0) event: everything the cuts and
+// the HistogramManager fills need, so they can be re-run without the
+// GENIE/RATPAC files.
+struct SkimEvent {
+    Int_t dataset;
+    Int_t file_nr;
+    Int_t evt_nr;
+
+    std::vector<double> in_ke;
+    std::vector<int> in_pdg;
+    std::vector<double> out_ke;
+    std::vector<int> out_pdg;
+
+    Double_t in_x, in_y, in_z;     // GENIE vertex (first particle) [mm]
+    Double_t out_x, out_y, out_z;  // RATPAC primary vertex [mm]
+    Double_t to_wall;              // Distance of the RATPAC vertex to the closest PMT wall [mm], negative
+                                   // outside the PMT box, NaN if the PMT geometry is unknown
+
+    Double_t scintPhotons, cherPhotons, remPhotons;
+    Double_t npe;
+    Double_t charge;  // Sum of mcPMTCharge, 0 like npe for outputs without PMT hits
+
+    SkimEvent();
+    void Clear();
+};
+
+class SkimManager {
+   public:
+    SkimManager();
+    ~SkimManager();
+
+    bool OpenOutput(const char* filename);
+    void Fill(const std::vector<SkimEvent>& events);
+    void CloseOutput();
+
+    Long64_t GetNEvents() const { return n_events; }
+
+    static bool Replay(const char* filename, HistogramManager& hm, Statistics& stats, bool* datasets_seen);
+
+   private:
+    TFile* skim_file;
+    TTree* skim_tree;
+    SkimEvent buffer;
+    Long64_t n_events;
+
+    std::mutex fill_mutex;
+};
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef STAGETIMER_H
+#define STAGETIMER_H
+
+#include <time.h>
+
+#include <chrono>
+#include <vector>
+
+// Wall and CPU time accumulated by one processing stage
+struct StageTime {
+    double wall;  // [s]
+    double cpu;   // [s], CPU time of the thread(s) that ran the stage
+    long long calls;
+
+    StageTime() : wall(0), cpu(0), calls(0) {}
+
+    void Add(const StageTime& other) {
+        wall += other.wall;
+        cpu += other.cpu;
+        calls += other.calls;
+    }
+
+    static double ThreadCPUSeconds() {
+        timespec ts;
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+        return ts.tv_sec + 1e-9 * ts.tv_nsec;
+    }
+};
+
+// Adds the time between construction and Stop() (or destruction) to a StageTime
+class StageTimer {
+   public:
+    explicit StageTimer(StageTime& t)
+        : stage(t), wall_start(std::chrono::steady_clock::now()), cpu_start(StageTime::ThreadCPUSeconds()), running(true) {}
+
+    ~StageTimer() { Stop(); }
+
+    void Stop() {
+        if (!running) return;
+        stage.wall += std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+        stage.cpu += StageTime::ThreadCPUSeconds() - cpu_start;
+        stage.calls++;
+        running = false;
+    }
+
+   private:
+    StageTime& stage;
+    std::chrono::steady_clock::time_point wall_start;
+    double cpu_start;
+    bool running;
+};
+
+// Splits one span (e.g. the event loop over a cluster) into sub-stages that
+// take turns many times within it. Switch() only reads the steady clock; on
+// Stop() (or destruction) each sub-stage gets its summed wall time, one call,
+// and a share of the span's thread CPU time in proportion to its wall time,
+// so the thread CPU clock is still read once per span.
+class StageSplitTimer {
+   public:
+    explicit StageSplitTimer(const std::vector<StageTime*>& s)
+        : stages(s), wall(s.size(), 0), current(-1), last(std::chrono::steady_clock::now()), cpu_start(StageTime::ThreadCPUSeconds()), running(true) {}
+
+    ~StageSplitTimer() { Stop(); }
+
+    // Time from now on goes to stages[i]; -1 to none
+    void Switch(int i) {
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (current >= 0) wall[current] += std::chrono::duration<double>(now - last).count();
+        last = now;
+        current = i;
+    }
+
+    void Stop() {
+        if (!running) return;
+        Switch(-1);
+        double cpu = StageTime::ThreadCPUSeconds() - cpu_start;
+        double wall_sum = 0;
+        for (double w : wall) wall_sum += w;
+        for (size_t i = 0; i < stages.size(); i++) {
+            stages[i]->wall += wall[i];
+            if (wall_sum > 0) stages[i]->cpu += cpu * wall[i] / wall_sum;
+            stages[i]->calls++;
+        }
+        running = false;
+    }
+
+   private:
+    std::vector<StageTime*> stages;
+    std::vector<double> wall;
+    int current;
+    std::chrono::steady_clock::time_point last;
+    double cpu_start;
+    bool running;
+};
+
+#endif
@@ -1,7 +1,12 @@
 #ifndef STATISTICS_H
 #define STATISTICS_H
 
+#include <TFile.h>
+
 #include <iostream>
+#include <vector>
+
+#include "StageTimer.h"
 
 class Statistics {
    public:
@@ -24,13 +29,60 @@ class Statistics {
     int n_diff_out_5xrange;
     int n_diff_1_10_MeV;
 
+    long long n_input_bytes_read;
+    long long n_input_bytes_unzipped;
+
+    long long n_output_bytes_read;
+    long long n_output_bytes_unzipped;
+
+    int n_prefetched_file_pairs;
+    int n_input_full_reads;  // Input files whose 'ds' branch could not be read in part
+    double t_file_open;       // Time spent opening file pairs [s], wherever it happened
+    double t_file_open_wait;  // Part of it the event loop was blocked on [s]
+
+    // Per-stage timing, summed over worker threads. Measured per file or per
+    // cluster, not per event; per-event averages are derived in the summary.
+    // The output read, input read and fill stages split the file's event loop
+    // (StageSplitTimer): one call per file, CPU time shared by wall time.
+    StageTime time_open;         // FileManager::OpenFiles, as seen by the event loop
+    StageTime time_output_read;  // Output (ratpac) GetEntry: cluster pre-filter and per-event reads
+    StageTime time_input_read;   // Input (genie) GetEntry
+    StageTime time_fill;         // ProcessEvent: cuts, histogram, PMT map and skim fills
+    StageTime time_event;        // Event loop, per cluster (pre-filter) or per file: all of the
+                                 // above except the cluster pre-filter reads
+    StageTime time_file;         // Whole EventProcessor::ProcessFile
+    StageTime time_write;        // Histogram writing up to and including the output file close
+
+    struct FileTiming {
+        int dataset;
+        int file_nr;
+        int n_events;
+        double wall;
+        double cpu;
+        long long input_bytes_read;
+        long long output_bytes_read;
+    };
+    std::vector<FileTiming> file_timings;  // One per valid file pair
+
     Statistics();
     void Reset();
+    void Add(const Statistics& other);
     void PrintSummary(const char* chunk_name) const;
 
+    // t_timing (one entry per run) and t_file_timing (one entry per file pair)
+    void WriteTimingTrees(TFile* file) const;
+
+    // Reopens a closed output file and adds the timing trees, so that
+    // time_write can include the close; false if the file cannot be written
+    bool AppendTimingTrees(const char* file_name) const;
+
+    // t_statistics: the counters above, one entry, summed when outputs are merged
+    void WriteStatisticsTree(TFile* file) const;
+
    private:
     void PrintLine(const char* label, int value) const;
     void PrintLine(const char* label, int value, int total, bool show_percent = true) const;
+    void PrintTimingSummary() const;
 };
 
 #endif
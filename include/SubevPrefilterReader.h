@@ -0,0 +1,102 @@
+#ifndef SUBEVPREFILTERREADER_H
+#define SUBEVPREFILTERREADER_H
+
+#include <TBranch.h>
+#include <TTree.h>
+
+#include <vector>
+
+#include "ArrayView.h"
+
+// What the production event loop uses of one matched (subev == 0) RATPAC
+// output entry. Branches that are missing or disabled read as -1 / empty.
+struct OutputEvent {
+    Int_t evid;
+    Int_t mcparticlecount;
+    Double_t mcx, mcy, mcz;
+    Double_t scintPhotons, cherPhotons, remPhotons;
+
+    ArrayView<int> mcpdgs;
+    ArrayView<double> mckes;
+    ArrayView<int> mcPMTID;
+    ArrayView<int> mcPMTNPE;
+    ArrayView<double> mcPMTCharge;
+    ArrayView<int> hitPMTID;
+    ArrayView<double> hitPMTTime;
+};
+
+// subev pre-filter for the output tree. For each cluster, 'subev' is read
+// for every entry first, and only the subev == 0 entries are read further:
+// their scalar branches, branch by branch, into small per-cluster arrays, and
+// their vector branches per event by GetEvent, viewed in place in the ROOT
+// branch buffers. This is not bulk I/O: every read is a per-entry
+// TBranch::GetEntry call; the gain is that the per-PMT vectors of the
+// subevents are never streamed. ROOT's bulk API (TBranch::GetBulkRead) only
+// reads branches of one fixed-size leaf, i.e. the scalars here, which are a
+// few bytes per entry; the std::vector branches that hold the bytes of these
+// files cannot be read with it.
+class SubevPrefilterReader {
+   public:
+    SubevPrefilterReader();
+
+    // Binds the branches of a new output tree; false if it has no 'subev'
+    bool Setup(TTree* tree);
+
+    // Reads the next cluster; false once the tree is exhausted. Adds the
+    // unzipped bytes to 'bytes'.
+    bool ReadNextCluster(Long64_t& bytes);
+
+    size_t GetNEvents() const { return entries.size(); }
+
+    // Reads the vector branches of event i of the current cluster and fills
+    // evt; its views stay valid until the next GetEvent. Adds the unzipped
+    // bytes to 'bytes'.
+    void GetEvent(size_t i, OutputEvent& evt, Long64_t& bytes);
+
+   private:
+    template <class T>
+    struct ScalarColumn {
+        TBranch* branch;
+        T buffer;
+        std::vector<T> values;
+
+        ScalarColumn() : branch(nullptr), buffer(0) {}
+        void Bind(TTree* tree, const char* name);
+        void Read(const std::vector<Long64_t>& entries, Long64_t& bytes);
+        T At(size_t i) const { return branch ? values[i] : T(-1); }
+    };
+
+    template <class T>
+    struct VectorColumn {
+        TBranch* branch;
+        std::vector<T>* buffer;  // Owned by ROOT
+
+        VectorColumn() : branch(nullptr), buffer(nullptr) {}
+        void Bind(TTree* tree, const char* name);
+        ArrayView<T> Read(Long64_t entry, Long64_t& bytes);
+    };
+
+    TTree* tree;
+    Long64_t n_entries;
+    Long64_t next_cluster_start;
+    std::vector<Long64_t> cluster_ends;  // Exclusive end entry of each cluster
+    size_t next_cluster;
+
+    std::vector<Long64_t> entries;  // Tree entries of the current cluster's events
+
+    ScalarColumn<Int_t> subev;
+    ScalarColumn<Int_t> evid;
+    ScalarColumn<Int_t> mcparticlecount;
+    ScalarColumn<Double_t> mcx, mcy, mcz;
+    ScalarColumn<Double_t> scintPhotons, cherPhotons, remPhotons;
+
+    VectorColumn<int> mcpdgs;
+    VectorColumn<double> mckes;
+    VectorColumn<int> mcPMTID;
+    VectorColumn<int> mcPMTNPE;
+    VectorColumn<double> mcPMTCharge;
+    VectorColumn<int> hitPMTID;
+    VectorColumn<double> hitPMTTime;
+};
+
+#endif
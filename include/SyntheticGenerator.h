@@ -0,0 +1,55 @@
+#ifndef SYNTHETICGENERATOR_H
+#define SYNTHETICGENERATOR_H
+
+#include <TRandom3.h>
+
+#include <string>
+#include <vector>
+
+#include "RAT/DS/Root.hh"
+
+// Writes GENIE-like input ('T' tree of RAT::DS::Root) and RATPAC-like output
+// ('output' and 'meta' trees) file pairs in the production directory layout
+// below a base directory (see FileManager::SetupLocalPaths), so validate()
+// and the benchmark can run on any machine.
+class SyntheticGenerator {
+   public:
+    struct Settings {
+        int n_files;              // File pairs per dataset
+        int n_events;             // Primary events per file pair
+        double mean_particles;    // Mean final state particle multiplicity (Poisson, >= 1)
+        int n_pmts;               // PMTs on the six detector walls
+        double subev_fraction;    // Fraction of output entries that are subevents (subev > 0)
+        double pe_per_MeV;        // Collected PEs per MeV of total KE
+        double nu_final_fraction; // Events with a neutrino in the final state
+        double mismatch_fraction; // Events whose RATPAC KE differs from the GENIE one
+        unsigned int seed;
+
+        Settings();
+    };
+
+    SyntheticGenerator(const Settings& settings);
+
+    // Writes file pairs 0..n_files-1 of one dataset chunk (e.g. "01_FHC_NBE_NBM"),
+    // then a stamp file with the settings used
+    bool Generate(const std::string& base, const std::string& chunk);
+
+    // True if the chunk was generated with exactly these settings
+    bool IsUpToDate(const std::string& base, const std::string& chunk) const;
+
+   private:
+    Settings cfg;
+    TRandom3 rng;
+
+    // Detector half sizes [mm], PMT positions on the walls
+    double half_x, half_y, half_z;
+    std::vector<int> pmt_id;
+    std::vector<double> pmt_x, pmt_y, pmt_z;
+
+    void BuildGeometry();
+    std::string SettingsStamp() const;
+    static std::string StampPath(const std::string& base, const std::string& chunk);
+    bool WriteFilePair(const std::string& input_name, const std::string& output_name);
+};
+
+#endif
@@ -1,6 +1,9 @@
 #ifndef VALIDATE_H
 #define VALIDATE_H
 
-extern "C" void validate(int dataset, bool debug, bool event_display);
+extern "C" void validate(int dataset, bool debug, bool event_display, int start_file, int n_threads, int prefetch_depth, bool multipage_display, int n_files);
+extern "C" int validate_skim(int dataset, int n_threads, int first_file, int end_file, int prefetch_depth);
+extern "C" int validate_range(int dataset, int first_file, int end_file, int shard, int n_shards, int n_threads, int prefetch_depth, const char* output_name);
+extern "C" int validate_replay(const char* skim_name, bool cut_nuFinal, bool cut_toWall, bool cut_Ematch, double E_tolerance, double distance_cut);
 
 #endif
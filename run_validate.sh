@@ -3,9 +3,16 @@
 # run_validate.sh - Run validation analysis on all datasets
 #
 # Usage:
-#   ./run_validate.sh                    # Run all datasets in production mode + merge
+#   ./run_validate.sh                    # Run all datasets in one process (per-dataset + combined histograms)
+#   ./run_validate.sh legacy             # Run one process per dataset, then validate_merge
 #   ./run_validate.sh debug [DS] [FILE]  # Run in debug mode (default: dataset 4, file 4)
 #   ./run_validate.sh dataset N          # Run specific dataset N
+#
+# Environment:
+#   VALIDATE_NTHREADS=N                  # Worker threads per dataset (default: 1)
+#   VALIDATE_FIRST=N                     # Production: first file pair (default: 0)
+#   VALIDATE_NFILES=N                    # Production: number of file pairs (default: 10)
+#   VALIDATE_MULTIPAGE=1                 # Debug mode: all event displays in one PDF (default: one PDF per event)
 
 # Colors for output
 RED='\033[0;31m'
@@ -33,6 +40,14 @@ DATASET_END=8
 DO_MERGE=false
 DEBUG_DATASET=4
 DEBUG_FILE=4
+NTHREADS=${VALIDATE_NTHREADS:-1}
+FIRST_FILE=${VALIDATE_FIRST:-0}
+NFILES=${VALIDATE_NFILES:-10}
+if [ "${VALIDATE_MULTIPAGE:-0}" == "1" ]; then
+    MULTIPAGE=true
+else
+    MULTIPAGE=false
+fi
 
 if [ "$1" == "debug" ]; then
     MODE="debug"
@@ -49,12 +64,18 @@ elif [ "$1" == "dataset" ] && [ -n "$2" ]; then
     DATASET_START=$2
     DATASET_END=$2
     echo -e "${YELLOW}Running dataset $2 only${NC}"
-elif [ -z "$1" ]; then
+elif [ "$1" == "legacy" ]; then
     DO_MERGE=true
-    echo -e "${YELLOW}Running all datasets in production mode (will merge at end)${NC}"
+    echo -e "${YELLOW}Running all datasets in production mode, one process per dataset (will merge at end)${NC}"
+elif [ -z "$1" ]; then
+    # Dataset 0 = all datasets in a single process; the combined histograms
+    # are filled in-process, so no hadd/merge stage is needed
+    DATASET_START=0
+    DATASET_END=0
+    echo -e "${YELLOW}Running all datasets in production mode (single process)${NC}"
 fi
 
-if [ ! -f "validate.so" ] || [ "validate.C" -nt "validate.so" ]; then
+if [ ! -f "validate.so" ] || [ ! -f "validate_merge" ] || [ "validate.C" -nt "validate.so" ]; then
     echo -e "${YELLOW}Compiling validate.C...${NC}"
     make clean
     make
@@ -73,25 +94,38 @@ declare -a OUTPUT_FILES
 for k in $(seq $DATASET_START $DATASET_END); do
     TIMESTAMP=$(date +"%Y-%m-%d %H:%M:%S")
     echo ""
-    echo -e "${GREEN}[$TIMESTAMP] Processing dataset $k...${NC}"
-
-    LOG_FILE="logs/validate_dataset_${k}_$(date +%Y%m%d_%H%M%S).log"
+    if [ "$k" -eq 0 ]; then
+        echo -e "${GREEN}[$TIMESTAMP] Processing all datasets...${NC}"
+        LOG_FILE="logs/validate_all_$(date +%Y%m%d_%H%M%S).log"
+    else
+        echo -e "${GREEN}[$TIMESTAMP] Processing dataset $k...${NC}"
+        LOG_FILE="logs/validate_dataset_${k}_$(date +%Y%m%d_%H%M%S).log"
+    fi
 
     if [ "$MODE" == "debug" ]; then
-        echo "  Running: root -l -q -e 'validate($k,true,true,$DEBUG_FILE)'"
+        echo "  Running: root -l -q -e 'validate($k,true,true,$DEBUG_FILE,1,1,$MULTIPAGE)'"
         echo "   - Dataset: $k, File: $DEBUG_FILE"
         echo "   - Note: Using .rootlogon.C to preload libraries"
-        root -l -q -e "validate($k,true,true,$DEBUG_FILE)" 2>&1 | tee "$LOG_FILE"
+        root -l -q -e "validate($k,true,true,$DEBUG_FILE,1,1,$MULTIPAGE)" 2>&1 | tee "$LOG_FILE"
     else
-        echo "  Running: root -b -l -q -e 'validate($k)'"
+        echo "  Running: root -b -l -q -e 'validate($k,false,false,$FIRST_FILE,$NTHREADS,1,false,$NFILES)'"
+        echo "   - Dataset: $k, Files: $FIRST_FILE to $((FIRST_FILE + NFILES - 1))"
         echo "   - Note: Using .rootlogon.C to preload libraries"
-        root -b -l -q -e "validate($k,false,false,0)" > "$LOG_FILE" 2>&1
+        root -b -l -q -e "validate($k,false,false,$FIRST_FILE,$NTHREADS,1,false,$NFILES)" > "$LOG_FILE" 2>&1
     fi
 
     if [ ${PIPESTATUS[0]} -eq 0 ]; then
-        echo -e "${GREEN}  ✓ Dataset $k completed successfully${NC}"
+        if [ "$k" -eq 0 ]; then
+            echo -e "${GREEN}  ✓ All datasets completed successfully${NC}"
+        else
+            echo -e "${GREEN}  ✓ Dataset $k completed successfully${NC}"
+        fi
 
-        NEWEST_FILE=$(ls -t validate_0${k}_*.root 2>/dev/null | head -1)
+        if [ "$k" -eq 0 ]; then
+            NEWEST_FILE=$(ls -t validate_all_*.root 2>/dev/null | head -1)
+        else
+            NEWEST_FILE=$(ls -t validate_0${k}_*.root 2>/dev/null | head -1)
+        fi
         if [ -n "$NEWEST_FILE" ]; then
             OUTPUT_FILES+=("$NEWEST_FILE")
             echo -e "${BLUE}    Found output: $NEWEST_FILE${NC}"
@@ -135,7 +169,8 @@ if [ "$DO_MERGE" = true ]; then
     else
         echo -e "${BLUE}Merging ${#OUTPUT_FILES[@]} files into ${MERGED_OUTPUT}...${NC}"
 
-        hadd -f "$MERGED_OUTPUT" "${OUTPUT_FILES[@]}" > "logs/merge_${MERGE_TIMESTAMP}.log" 2>&1
+        # Sums the dataset outputs and builds the *_combined histograms in one pass
+        ./validate_merge -j "$NTHREADS" -o "$MERGED_OUTPUT" "${OUTPUT_FILES[@]}" > "logs/merge_${MERGE_TIMESTAMP}.log" 2>&1
 
         if [ $? -eq 0 ]; then
             echo -e "${GREEN}✓ Merge successful!${NC}"
@@ -144,17 +179,6 @@ if [ "$DO_MERGE" = true ]; then
             SIZE=$(du -h "$MERGED_OUTPUT" | cut -f1)
             echo -e "${GREEN}  File size: ${SIZE}${NC}"
 
-            echo ""
-            echo -e "${BLUE}Creating combined histograms (summing all datasets)...${NC}"
-
-            root -b -l -q "merge_datasets.C(\"$MERGED_OUTPUT\")" > "logs/combine_${MERGE_TIMESTAMP}.log" 2>&1
-
-            if [ $? -eq 0 ]; then
-                echo -e "${GREEN}✓ Combined histograms created successfully${NC}"
-            else
-                echo -e "${YELLOW}⚠ Warning: Combined histogram creation had issues. Check logs/combine_${MERGE_TIMESTAMP}.log${NC}"
-            fi
-
             # echo ""
             # echo -e "${BLUE}Creating per-dataset merged files...${NC}"
             # for ds in $(seq 1 8); do